@@ -0,0 +1,34 @@
+/**
+ * Capital Hopping Benchmark Bot
+ *
+ * Tries to move its capital to every owned city each turn. Most attempts
+ * fail the population check; the ones that succeed move the capital
+ * repeatedly. Stresses ensi_move_capital and capital bookkeeping.
+ *
+ * Build:
+ *   cd ../../sdk && make bench
+ */
+
+#include "../ensi.h"
+
+int run_turn(int fuel_budget) {
+    (void)fuel_budget;
+
+    int player_id = ensi_get_player_id();
+    int width = ensi_tile_map_width();
+    int height = ensi_tile_map_height();
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int tile = ensi_tile_map_get(x, y);
+            if (!TILE_OWNED_BY(tile, player_id)) continue;
+            if (!TILE_IS_CITY(tile)) continue;
+
+            ensi_move_capital(x, y);
+        }
+    }
+
+    ensi_yield();
+
+    return 0;
+}
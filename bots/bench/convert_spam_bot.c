@@ -0,0 +1,39 @@
+/**
+ * Convert Spam Benchmark Bot
+ *
+ * Converts population to army one unit at a time in every owned city, up to
+ * MAX_CONVERTS_PER_CITY attempts per city or until the host rejects the
+ * command. Stresses ensi_convert validation.
+ *
+ * Build:
+ *   cd ../../sdk && make bench
+ */
+
+#include "../ensi.h"
+
+/** Upper bound on conversions per city per turn. */
+#define MAX_CONVERTS_PER_CITY 64
+
+int run_turn(int fuel_budget) {
+    (void)fuel_budget;
+
+    int player_id = ensi_get_player_id();
+    int width = ensi_tile_map_width();
+    int height = ensi_tile_map_height();
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int tile = ensi_tile_map_get(x, y);
+            if (!TILE_OWNED_BY(tile, player_id)) continue;
+            if (!TILE_IS_CITY(tile)) continue;
+
+            for (int i = 0; i < MAX_CONVERTS_PER_CITY; i++) {
+                if (ensi_convert(x, y, 1) != 0) break;
+            }
+        }
+    }
+
+    ensi_yield();
+
+    return 0;
+}
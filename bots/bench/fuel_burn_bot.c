@@ -0,0 +1,22 @@
+/**
+ * Fuel Burning Benchmark Bot
+ *
+ * Spins until the engine stops it and never calls ensi_yield(). Every turn
+ * ends by fuel exhaustion, which stresses fuel metering and the trap path.
+ *
+ * Build:
+ *   cd ../../sdk && make bench
+ */
+
+#include "../ensi.h"
+
+/** Volatile so the loop is kept and touches memory on every iteration. */
+static volatile unsigned int spin = 0;
+
+int run_turn(int fuel_budget) {
+    (void)fuel_budget;
+
+    for (;;) {
+        spin = spin + 1;
+    }
+}
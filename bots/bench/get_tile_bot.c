@@ -0,0 +1,31 @@
+/**
+ * Get-Tile Benchmark Bot
+ *
+ * Scans the full map through the ensi_get_tile() host call instead of the
+ * pushed tile map. Stresses the slow query path used by legacy bots.
+ *
+ * Build:
+ *   cd ../../sdk && make bench
+ */
+
+#include "../ensi.h"
+
+/** Accumulated across turns so the scan cannot be optimized away. */
+static unsigned int checksum = 0;
+
+int run_turn(int fuel_budget) {
+    (void)fuel_budget;
+
+    int width = ensi_get_map_width();
+    int height = ensi_get_map_height();
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            checksum += (unsigned int)ensi_get_tile(x, y);
+        }
+    }
+
+    ensi_yield();
+
+    return (int)(checksum & 1);
+}
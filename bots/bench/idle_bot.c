@@ -0,0 +1,19 @@
+/**
+ * Idle Benchmark Bot
+ *
+ * Yields immediately every turn. With every player running this bot the
+ * game measures pure engine overhead (the "physics limit").
+ *
+ * Build:
+ *   cd ../../sdk && make bench
+ */
+
+#include "../ensi.h"
+
+int run_turn(int fuel_budget) {
+    (void)fuel_budget;
+
+    ensi_yield();
+
+    return 0;
+}
@@ -0,0 +1,34 @@
+/**
+ * Memory Growth Benchmark Bot
+ *
+ * Grows its linear memory by one 64 KiB page per turn and writes to every
+ * cache line of the new page. Stresses memory.grow and the resident size
+ * of bot instances over a long game.
+ *
+ * Build:
+ *   cd ../../sdk && make bench
+ */
+
+#include "../ensi.h"
+
+/** Size of a WASM page in bytes. */
+#define WASM_PAGE_SIZE 65536
+/** Stride used to touch a freshly grown page. */
+#define CACHE_LINE_SIZE 64
+
+int run_turn(int fuel_budget) {
+    (void)fuel_budget;
+
+    int old_pages = (int)__builtin_wasm_memory_grow(0, 1);
+    if (old_pages >= 0) {
+        volatile unsigned char* page =
+            (volatile unsigned char*)((unsigned long)old_pages * WASM_PAGE_SIZE);
+        for (int i = 0; i < WASM_PAGE_SIZE; i += CACHE_LINE_SIZE) {
+            page[i] = 1;
+        }
+    }
+
+    ensi_yield();
+
+    return 0;
+}
@@ -0,0 +1,38 @@
+/**
+ * Move Spam Benchmark Bot
+ *
+ * Issues a single-unit move from every owned tile towards every adjacent
+ * tile, every turn, whether or not the move can succeed. Stresses host-side
+ * command validation and the command queue.
+ *
+ * Build:
+ *   cd ../../sdk && make bench
+ */
+
+#include "../ensi.h"
+
+int run_turn(int fuel_budget) {
+    (void)fuel_budget;
+
+    int player_id = ensi_get_player_id();
+    int width = ensi_tile_map_width();
+    int height = ensi_tile_map_height();
+
+    int dx[] = {0, 0, -1, 1};
+    int dy[] = {-1, 1, 0, 0};
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int tile = ensi_tile_map_get(x, y);
+            if (!TILE_OWNED_BY(tile, player_id)) continue;
+
+            for (int d = 0; d < 4; d++) {
+                ensi_move(x, y, x + dx[d], y + dy[d], 1);
+            }
+        }
+    }
+
+    ensi_yield();
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+/**
+ * Map Scan Benchmark Bot
+ *
+ * Reads every tile of the push-based visibility map each turn and issues
+ * no commands. Stresses the per-turn tile map push and guest memory reads.
+ *
+ * Build:
+ *   cd ../../sdk && make bench
+ */
+
+#include "../ensi.h"
+
+/** Accumulated across turns so the scan cannot be optimized away. */
+static unsigned int checksum = 0;
+
+int run_turn(int fuel_budget) {
+    (void)fuel_budget;
+
+    int width = ensi_tile_map_width();
+    int height = ensi_tile_map_height();
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            checksum += (unsigned int)ensi_tile_map_get(x, y);
+        }
+    }
+
+    ensi_yield();
+
+    return (int)(checksum & 1);
+}
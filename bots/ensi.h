@@ -212,6 +212,46 @@ static inline int ensi_tile_map_get(int x, int y) {
     return (int)tiles[y * width + x];
 }
 
+/**
+ * Check whether the host has written the tile map header ("ENSI" magic).
+ * @return Non-zero if the pushed map is present.
+ */
+static inline int ensi_tile_map_present(void) {
+    const unsigned char* magic = (const unsigned char*)ENSI_TILE_MAP_BASE;
+    return magic[0] == 'E' && magic[1] == 'N' && magic[2] == 'S' && magic[3] == 'I';
+}
+
+/**
+ * Get tile information, reading the pushed map when possible.
+ *
+ * Commands are queued until the end of the turn, so the pushed map matches
+ * what ensi_get_tile() would return. Falls back to the host call when the
+ * map header is missing or the coordinates are out of bounds.
+ *
+ * @param x X coordinate.
+ * @param y Y coordinate.
+ * @return Packed tile info (same format as ensi_get_tile).
+ */
+static inline int ensi_tile_map_get_or_query(int x, int y) {
+    if (!ensi_tile_map_present() ||
+        x < 0 || x >= ensi_tile_map_width() || y < 0 || y >= ensi_tile_map_height()) {
+        return ensi_get_tile(x, y);
+    }
+    return ensi_tile_map_get(x, y);
+}
+
+/**
+ * Define ENSI_GET_TILE_FROM_MAP before including this header to route every
+ * ensi_get_tile() reference through ensi_tile_map_get_or_query(). C bots
+ * get the fast path by recompiling. The object-like macro also renames a
+ * bot's own `extern int ensi_get_tile(int x, int y);` declaration, which
+ * then just redeclares the inline helper. Evolved genomes are emitted as
+ * wasm directly, not compiled from C, and are not affected.
+ */
+#ifdef ENSI_GET_TILE_FROM_MAP
+#define ensi_get_tile ensi_tile_map_get_or_query
+#endif
+
 /*============================================================================
  * Helper Macros
  *============================================================================*/